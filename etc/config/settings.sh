@@ -355,6 +355,27 @@ system)
         fi
         unset cudaHome
         ;;
+    GccThrust)
+        # thrust algorithms on the host through the OMP or TBB backend
+        export WM_CC='gcc'
+        export WM_CXX='g++'
+        : ${WM_THRUST_DEVICE_SYSTEM:=OMP}; export WM_THRUST_DEVICE_SYSTEM
+
+        # thrust is header-only: take it from THRUST_HOME or a CUDA toolkit
+        if [ -d "$THRUST_HOME" ]
+        then
+            export THRUST_INCLUDE=-I$THRUST_HOME
+        elif [ -n "$CUDA_HOME" -a -d "$CUDA_HOME/include/thrust" ]
+        then
+            export THRUST_INCLUDE=-I$CUDA_HOME/include
+        else
+            echo 1>&2
+            echo "Warning in $WM_PROJECT_DIR/etc/config/settings.sh:" 1>&2
+            echo "    Cannot find thrust, set THRUST_HOME." 1>&2
+            echo 1>&2
+            export THRUST_INCLUDE=
+        fi
+        ;;
     esac
     # okay, use system compiler
     ;;